@@ -183,6 +183,15 @@ int load_depth_pgm(uint16_t** depth_image_data,
 
 static inline Eigen::Vector2i round_pixel(const Eigen::Vector2f& pixel_f);
 
+/**
+ * Round each of the \p num_pixels sub-pixel positions in \p pixels_f to the nearest pixel position
+ * in \p pixels. Equivalent to calling se::round_pixel() per pixel but processes the whole batch
+ * with vectorized operations on the underlying coefficient arrays, which is considerably faster
+ * when rounding entire images.
+ */
+static inline void
+round_pixels(const Eigen::Vector2f* pixels_f, Eigen::Vector2i* pixels, const size_t num_pixels);
+
 } // namespace se
 
 #include "impl/image_utils_impl.hpp"
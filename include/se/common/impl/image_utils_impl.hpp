@@ -14,6 +14,22 @@ static inline Eigen::Vector2i round_pixel(const Eigen::Vector2f& pixel_f)
     return (pixel_f + Eigen::Vector2f::Constant(0.5f)).cast<int>();
 }
 
+
+
+static inline void
+round_pixels(const Eigen::Vector2f* pixels_f, Eigen::Vector2i* pixels, const size_t num_pixels)
+{
+    if (num_pixels == 0) {
+        return;
+    }
+    // Eigen::Vector2f and Eigen::Vector2i arrays are contiguous so the batch can be processed as
+    // flat coefficient arrays, which Eigen vectorizes with the SIMD instruction set enabled at
+    // compile time. This performs the same +0.5 and truncation as se::round_pixel().
+    const Eigen::Map<const Eigen::ArrayXf> coeffs_f(pixels_f[0].data(), 2 * num_pixels);
+    Eigen::Map<Eigen::ArrayXi> coeffs(pixels[0].data(), 2 * num_pixels);
+    coeffs = (coeffs_f + 0.5f).cast<int>();
+}
+
 } // namespace se
 
 #endif // SE_IMAGE_UTILS_IMPL_HPP
@@ -9,6 +9,8 @@
 #ifndef SE_EDGE_TABLES_HPP
 #define SE_EDGE_TABLES_HPP
 
+#include <array>
+
 constexpr int edgeTable[256] = {
     0x0,   0x109, 0x203, 0x30a, 0x406, 0x50f, 0x605, 0x70c, 0x80c, 0x905, 0xa0f, 0xb06, 0xc0a,
     0xd03, 0xe09, 0xf00, 0x190, 0x99,  0x393, 0x29a, 0x596, 0x49f, 0x795, 0x69c, 0x99c, 0x895,
@@ -302,4 +304,17 @@ static_assert(
     }(),
     "The last element of each row of triTable must be -1.");
 
+/** The number of triangles in each row of triTable. */
+constexpr std::array<int, 256> triCountTable = []() {
+    std::array<int, 256> counts{};
+    for (int i = 0; i < 256; i++) {
+        int n = 0;
+        while (triTable[i][3 * n] != -1) {
+            n++;
+        }
+        counts[i] = n;
+    }
+    return counts;
+}();
+
 #endif // SE_EDGE_TABLES_HPP
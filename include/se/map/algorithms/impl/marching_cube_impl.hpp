@@ -147,14 +147,15 @@ void gather_data(const BlockT* block_ptr,
                  const int y,
                  const int z)
 {
-    data_arr[0] = block_ptr->data(Eigen::Vector3i(x, y, z));
-    data_arr[1] = block_ptr->data(Eigen::Vector3i(x + 1, y, z));
-    data_arr[2] = block_ptr->data(Eigen::Vector3i(x + 1, y, z + 1));
-    data_arr[3] = block_ptr->data(Eigen::Vector3i(x, y, z + 1));
-    data_arr[4] = block_ptr->data(Eigen::Vector3i(x, y + 1, z));
-    data_arr[5] = block_ptr->data(Eigen::Vector3i(x + 1, y + 1, z));
-    data_arr[6] = block_ptr->data(Eigen::Vector3i(x + 1, y + 1, z + 1));
-    data_arr[7] = block_ptr->data(Eigen::Vector3i(x, y + 1, z + 1));
+    const Eigen::Vector3i corner_coords[8] = {Eigen::Vector3i(x, y, z),
+                                              Eigen::Vector3i(x + 1, y, z),
+                                              Eigen::Vector3i(x + 1, y, z + 1),
+                                              Eigen::Vector3i(x, y, z + 1),
+                                              Eigen::Vector3i(x, y + 1, z),
+                                              Eigen::Vector3i(x + 1, y + 1, z),
+                                              Eigen::Vector3i(x + 1, y + 1, z + 1),
+                                              Eigen::Vector3i(x, y + 1, z + 1)};
+    block_ptr->dataBatch(corner_coords, data_arr, 8);
 }
 
 
@@ -279,11 +280,60 @@ void gather_dual_data(const BlockT* block_ptr,
     // In the local case:        actual_dual_offset = actual_dual_scaling * norm_dual_offset_f and
     // dual_corner_coords_f = primal_corner_coord_f + actual_dual_scaling * norm_dual_offset_f
     const float actual_dual_scaling = (float) octantops::scale_to_size(scale) / 2;
+    Eigen::Vector3i dual_corner_sample_coords[8];
     for (int corner_idx = 0; corner_idx < 8; corner_idx++) {
         dual_corner_coords_i[corner_idx] = primal_corner_coord + logical_dual_offset[corner_idx];
         dual_corner_coords_f[corner_idx] =
             primal_corner_coord_f + actual_dual_scaling * norm_dual_offset_f[corner_idx];
-        data_arr[corner_idx] = block_ptr->data(dual_corner_coords_f[corner_idx].cast<int>(), scale);
+        dual_corner_sample_coords[corner_idx] = dual_corner_coords_f[corner_idx].cast<int>();
+    }
+    block_ptr->dataBatch(dual_corner_sample_coords, data_arr, 8, scale);
+}
+
+
+
+template<typename BlockT, typename DataT>
+void gather_cell_data(const BlockT* block_ptr, const int scale, DataT* cell_data)
+{
+    const int stride = octantops::scale_to_size(scale);
+    const int num_cells = BlockT::size / stride;
+    Eigen::Vector3i cell_coords[BlockT::size_cu];
+    int cell_idx = 0;
+    for (int z = 0; z < num_cells; z++) {
+        for (int y = 0; y < num_cells; y++) {
+            for (int x = 0; x < num_cells; x++) {
+                cell_coords[cell_idx++] = block_ptr->coord + stride * Eigen::Vector3i(x, y, z);
+            }
+        }
+    }
+    block_ptr->dataBatch(cell_coords, cell_data, cell_idx, scale);
+}
+
+
+
+template<typename BlockT, typename DataT>
+void gather_dual_data(const BlockT* block_ptr,
+                      const int scale,
+                      const Eigen::Vector3i& primal_corner_coord,
+                      const DataT* cell_data,
+                      DataT data_arr[8],
+                      std::array<Eigen::Vector3f, 8>& dual_corner_coords_f,
+                      std::array<Eigen::Vector3i, 8>& dual_corner_coords_i)
+{
+    const Eigen::Vector3f primal_corner_coord_f = primal_corner_coord.cast<float>();
+    const int stride = octantops::scale_to_size(scale);
+    const int num_cells = BlockT::size / stride;
+    const float actual_dual_scaling = (float) stride / 2;
+    for (int corner_idx = 0; corner_idx < 8; corner_idx++) {
+        dual_corner_coords_i[corner_idx] = primal_corner_coord + logical_dual_offset[corner_idx];
+        dual_corner_coords_f[corner_idx] =
+            primal_corner_coord_f + actual_dual_scaling * norm_dual_offset_f[corner_idx];
+        // The sample coordinates are contained in the cell of the cache computed below since the
+        // primal corner is in the block interior.
+        const Eigen::Vector3i cell_coord =
+            (dual_corner_coords_f[corner_idx].cast<int>() - block_ptr->coord) / stride;
+        data_arr[corner_idx] =
+            cell_data[cell_coord.x() + num_cells * (cell_coord.y() + num_cells * cell_coord.z())];
     }
 }
 
@@ -729,13 +779,22 @@ void gather_dual_data(const OctreeT& octree,
         }
     }
 
+    // Gather the data of all dual corners contained in the same block with a single batched
+    // lookup to amortize the per-block overhead over all corners resolving to it.
+    Eigen::Vector3i batch_coords[8];
+    typename OctreeT::DataType batch_data[8];
     const int stride = octantops::scale_to_size(scale);
-    for (const auto& offset_idx : neighbours[0]) {
+    for (size_t i = 0; i < neighbours[0].size(); i++) {
+        const int offset_idx = neighbours[0][i];
         dual_corner_coords_i[offset_idx] = primal_corner_coord + logical_dual_offset[offset_idx];
         dual_corner_coords_f[offset_idx] =
             ((dual_corner_coords_i[offset_idx] / stride) * stride).cast<float>()
             + stride * se::sample_offset_frac; // TODO:  OctreeT<FieldType>::sample_offset_frac_
-        data_arr[offset_idx] = block_ptr->data(dual_corner_coords_f[offset_idx].cast<int>(), scale);
+        batch_coords[i] = dual_corner_coords_f[offset_idx].cast<int>();
+    }
+    block_ptr->dataBatch(batch_coords, batch_data, neighbours[0].size(), scale);
+    for (size_t i = 0; i < neighbours[0].size(); i++) {
+        data_arr[neighbours[0][i]] = batch_data[i];
     }
     for (size_t neighbour_idx = 1; neighbour_idx < neighbours.size(); ++neighbour_idx) {
         Eigen::Vector3i logical_dual_corner_coord =
@@ -744,7 +803,8 @@ void gather_dual_data(const OctreeT& octree,
             se::fetcher::template block<OctreeT>(logical_dual_corner_coord, octree.getRoot()));
         const int neighbour_scale = std::max(block_neighbour_ptr->current_scale, scale);
         const int neighbour_stride = octantops::scale_to_size(neighbour_scale);
-        for (const auto& offset_idx : neighbours[neighbour_idx]) {
+        for (size_t i = 0; i < neighbours[neighbour_idx].size(); i++) {
+            const int offset_idx = neighbours[neighbour_idx][i];
             dual_corner_coords_i[offset_idx] =
                 primal_corner_coord + logical_dual_offset[offset_idx];
             dual_corner_coords_f[offset_idx] =
@@ -752,8 +812,12 @@ void gather_dual_data(const OctreeT& octree,
                     .cast<float>()
                 + neighbour_stride
                     * se::sample_offset_frac; // TODO: OctreeT<FieldType>::sample_offset_frac_
-            data_arr[offset_idx] = block_neighbour_ptr->data(
-                dual_corner_coords_f[offset_idx].cast<int>(), neighbour_scale);
+            batch_coords[i] = dual_corner_coords_f[offset_idx].cast<int>();
+        }
+        block_neighbour_ptr->dataBatch(
+            batch_coords, batch_data, neighbours[neighbour_idx].size(), neighbour_scale);
+        for (size_t i = 0; i < neighbours[neighbour_idx].size(); i++) {
+            data_arr[neighbours[neighbour_idx][i]] = batch_data[i];
         }
     }
 }
@@ -811,10 +875,81 @@ void compute_dual_index(const OctreeT& octree,
 
 
 
+template<typename OctreeT, typename DataT, typename DataToIndexF>
+void compute_dual_index(const OctreeT& octree,
+                        const typename OctreeT::BlockType* block_ptr,
+                        const int scale,
+                        const Eigen::Vector3i& primal_corner_coord,
+                        const DataT* cell_data,
+                        uint8_t& edge_pattern_idx,
+                        DataT data[8],
+                        std::array<Eigen::Vector3f, 8>& dual_corner_coords_f,
+                        std::array<Eigen::Vector3i, 8>& dual_corner_coords_i,
+                        DataToIndexF data_to_index)
+{
+    const unsigned int block_size = block_ptr->size;
+    // See se::meshing::compute_dual_index() for the meaning of local.
+    const unsigned int local = ((primal_corner_coord.x() % block_size == 0) << 2)
+        | ((primal_corner_coord.y() % block_size == 0) << 1)
+        | (primal_corner_coord.z() % block_size == 0);
+
+    if (!local) {
+        gather_dual_data(block_ptr,
+                         scale,
+                         primal_corner_coord,
+                         cell_data,
+                         data,
+                         dual_corner_coords_f,
+                         dual_corner_coords_i);
+    }
+    else {
+        gather_dual_data(octree,
+                         block_ptr,
+                         scale,
+                         primal_corner_coord,
+                         data,
+                         dual_corner_coords_f,
+                         dual_corner_coords_i);
+    }
+
+    edge_pattern_idx = data_to_index(data);
+}
+
+
+
 inline bool checkVertex(const Eigen::Vector3f& vertex_M, const float dim)
 {
-    return (vertex_M.x() <= 0 || vertex_M.y() <= 0 || vertex_M.z() <= 0 || vertex_M.x() > dim
-            || vertex_M.y() > dim || vertex_M.z() > dim);
+    return ((vertex_M.array() <= 0.0f) || (vertex_M.array() > dim)).any();
+}
+
+
+
+template<size_t NumVertexes>
+bool checkVertexes(const std::array<Eigen::Vector3f, NumVertexes>& vertexes_M, const float dim)
+{
+    // The vertices are contiguous so all coefficients can be tested with vectorized, branchless
+    // comparisons instead of a chain of short-circuiting scalar tests per vertex.
+    const Eigen::Map<const Eigen::Array<float, 3 * NumVertexes, 1>> coeffs(vertexes_M[0].data());
+    return ((coeffs <= 0.0f) || (coeffs > dim)).any();
+}
+
+
+
+template<typename MeshT>
+void remove_skipped_faces(MeshT& mesh,
+                          const std::vector<size_t>& block_face_begin,
+                          const std::vector<size_t>& block_face_end)
+{
+    size_t num_faces = 0;
+    for (size_t block_idx = 0; block_idx < block_face_end.size(); block_idx++) {
+        const size_t begin = block_face_begin[block_idx];
+        const size_t end = block_face_end[block_idx];
+        if (begin != num_faces) {
+            std::move(mesh.begin() + begin, mesh.begin() + end, mesh.begin() + num_faces);
+        }
+        num_faces += end - begin;
+    }
+    mesh.resize(num_faces);
 }
 
 
@@ -834,10 +969,40 @@ marching_cube_kernel(const OctreeT& octree,
 {
     typedef typename OctreeT::SurfaceMesh::value_type Face;
 
-    typename OctreeT::SurfaceMesh mesh;
+    // Count the triangles each block will emit so that each block can write its faces to a
+    // preallocated region of the mesh without synchronization. The counts are upper bounds since
+    // faces with invalid vertices are skipped during emission.
+    std::vector<size_t> block_face_begin(block_ptrs.size() + 1, 0);
 #pragma omp parallel for
     for (size_t block_idx = 0; block_idx < block_ptrs.size(); block_idx++) {
         const typename OctreeT::BlockType* const block_ptr = block_ptrs[block_idx];
+        const Eigen::Vector3i& start_coord = block_ptr->coord;
+        const Eigen::Vector3i last_coord =
+            (start_coord + Eigen::Vector3i::Constant(OctreeT::BlockType::size))
+                .cwiseMin(Eigen::Vector3i::Constant(octree.getSize() - 1));
+        size_t num_block_faces = 0;
+        for (int x = start_coord.x(); x < last_coord.x(); x++) {
+            for (int y = start_coord.y(); y < last_coord.y(); y++) {
+                for (int z = start_coord.z(); z < last_coord.z(); z++) {
+                    const uint8_t edge_pattern_idx = meshing::compute_index(
+                        octree, block_ptr, x, y, z, meshing::isosurface::occupied);
+                    num_block_faces += triCountTable[edge_pattern_idx];
+                }
+            }
+        }
+        block_face_begin[block_idx + 1] = num_block_faces;
+    }
+    // Exclusive scan of the per-block counts to get the offset each block writes its faces at.
+    for (size_t block_idx = 1; block_idx < block_face_begin.size(); block_idx++) {
+        block_face_begin[block_idx] += block_face_begin[block_idx - 1];
+    }
+
+    typename OctreeT::SurfaceMesh mesh(block_face_begin.back());
+    std::vector<size_t> block_face_end(block_ptrs.size(), 0);
+#pragma omp parallel for
+    for (size_t block_idx = 0; block_idx < block_ptrs.size(); block_idx++) {
+        const typename OctreeT::BlockType* const block_ptr = block_ptrs[block_idx];
+        size_t face_idx = block_face_begin[block_idx];
 
         const Eigen::Vector3i& start_coord = block_ptr->coord;
         const Eigen::Vector3i last_coord =
@@ -854,9 +1019,9 @@ marching_cube_kernel(const OctreeT& octree,
                         for (size_t v = 0; v < Face::num_vertexes; v++) {
                             face.vertexes[v] =
                                 meshing::interp_vertexes(octree, x, y, z, edges[e + v]);
-                            if (meshing::checkVertex(face.vertexes[v], octree.getSize())) {
-                                goto skip_face;
-                            }
+                        }
+                        if (meshing::checkVertexes(face.vertexes, octree.getSize())) {
+                            continue;
                         }
                         if constexpr (Face::col_ == Colour::On) {
                             // Using a separate loop than the vertex computation to avoid the
@@ -874,16 +1039,15 @@ marching_cube_kernel(const OctreeT& octree,
                             face.id.id =
                                 visitor::getData(octree, block_ptr, Eigen::Vector3i(x, y, z)).id.id;
                         }
-#pragma omp critical(marching_cubes)
-                        {
-                            mesh.push_back(face);
-                        }
-                    skip_face:;
+                        mesh[face_idx++] = face;
                     }
                 }
             }
         }
+        block_face_end[block_idx] = face_idx;
     }
+
+    meshing::remove_skipped_faces(mesh, block_face_begin, block_face_end);
     mesh.shrink_to_fit();
     return mesh;
 }
@@ -900,7 +1064,10 @@ dual_marching_cube_kernel(const OctreeT& octree,
     assert(min_desired_scale <= OctreeT::BlockType::max_scale);
     typedef typename OctreeT::SurfaceMesh::value_type Face;
 
-    typename OctreeT::SurfaceMesh mesh;
+    // Count the triangles each block will emit so that each block can write its faces to a
+    // preallocated region of the mesh without synchronization. The counts are upper bounds since
+    // faces with invalid vertices are skipped during emission.
+    std::vector<size_t> block_face_begin(block_ptrs.size() + 1, 0);
 #pragma omp parallel for
     for (size_t block_idx = 0; block_idx < block_ptrs.size(); block_idx++) {
         const typename OctreeT::BlockType* const block_ptr = block_ptrs[block_idx];
@@ -911,6 +1078,12 @@ dual_marching_cube_kernel(const OctreeT& octree,
         const Eigen::Vector3i last_coord =
             (start_coord + Eigen::Vector3i::Constant(OctreeT::BlockType::size))
                 .cwiseMin(Eigen::Vector3i::Constant(octree.getSize() - 1));
+        // Cache the data of all block cells at voxel_scale once; primal corners in the block
+        // interior read their 8 dual corner data from the cache instead of fetching each cell from
+        // the block up to 8 times.
+        std::array<typename OctreeT::DataType, OctreeT::BlockType::size_cu> cell_data;
+        meshing::gather_cell_data(block_ptr, voxel_scale, cell_data.data());
+        size_t num_block_faces = 0;
         for (int x = start_coord.x(); x <= last_coord.x(); x += voxel_stride) {
             for (int y = start_coord.y(); y <= last_coord.y(); y += voxel_stride) {
                 for (int z = start_coord.z(); z <= last_coord.z(); z += voxel_stride) {
@@ -932,6 +1105,61 @@ dual_marching_cube_kernel(const OctreeT& octree,
                                                 block_ptr,
                                                 voxel_scale,
                                                 primal_corner_coord,
+                                                cell_data.data(),
+                                                edge_pattern_idx,
+                                                data,
+                                                dual_corner_coords_f,
+                                                dual_corner_coords_i,
+                                                meshing::isosurface::occupied);
+                    num_block_faces += triCountTable[edge_pattern_idx];
+                }
+            }
+        }
+        block_face_begin[block_idx + 1] = num_block_faces;
+    }
+    // Exclusive scan of the per-block counts to get the offset each block writes its faces at.
+    for (size_t block_idx = 1; block_idx < block_face_begin.size(); block_idx++) {
+        block_face_begin[block_idx] += block_face_begin[block_idx - 1];
+    }
+
+    typename OctreeT::SurfaceMesh mesh(block_face_begin.back());
+    std::vector<size_t> block_face_end(block_ptrs.size(), 0);
+#pragma omp parallel for
+    for (size_t block_idx = 0; block_idx < block_ptrs.size(); block_idx++) {
+        const typename OctreeT::BlockType* const block_ptr = block_ptrs[block_idx];
+        size_t face_idx = block_face_begin[block_idx];
+        const int voxel_scale =
+            std::clamp(min_desired_scale, block_ptr->current_scale, OctreeT::BlockType::max_scale);
+        const int voxel_stride = octantops::scale_to_size(voxel_scale);
+        const Eigen::Vector3i& start_coord = block_ptr->coord;
+        const Eigen::Vector3i last_coord =
+            (start_coord + Eigen::Vector3i::Constant(OctreeT::BlockType::size))
+                .cwiseMin(Eigen::Vector3i::Constant(octree.getSize() - 1));
+        // Same per-block cell data cache as in the counting pass above.
+        std::array<typename OctreeT::DataType, OctreeT::BlockType::size_cu> cell_data;
+        meshing::gather_cell_data(block_ptr, voxel_scale, cell_data.data());
+        for (int x = start_coord.x(); x <= last_coord.x(); x += voxel_stride) {
+            for (int y = start_coord.y(); y <= last_coord.y(); y += voxel_stride) {
+                for (int z = start_coord.z(); z <= last_coord.z(); z += voxel_stride) {
+                    const Eigen::Vector3i primal_corner_coord = Eigen::Vector3i(x, y, z);
+
+                    if (x == last_coord.x() || y == last_coord.y() || z == last_coord.z()) {
+                        if (!se::fetcher::template block<OctreeT>(primal_corner_coord,
+                                                                  octree.getRoot())) {
+                            continue;
+                        }
+                    }
+
+                    uint8_t edge_pattern_idx;
+                    typename OctreeT::DataType data[8];
+                    std::array<Eigen::Vector3f, 8> dual_corner_coords_f;
+                    std::array<Eigen::Vector3i, 8> dual_corner_coords_i;
+                    dual_corner_coords_f.fill(Eigen::Vector3f::Zero());
+                    meshing::compute_dual_index(octree,
+                                                block_ptr,
+                                                voxel_scale,
+                                                primal_corner_coord,
+                                                cell_data.data(),
                                                 edge_pattern_idx,
                                                 data,
                                                 dual_corner_coords_f,
@@ -943,9 +1171,9 @@ dual_marching_cube_kernel(const OctreeT& octree,
                         for (size_t v = 0; v < Face::num_vertexes; v++) {
                             face.vertexes[v] = meshing::interp_dual_vertexes(
                                 edges[e + v], data, dual_corner_coords_f);
-                            if (meshing::checkVertex(face.vertexes[v], octree.getSize())) {
-                                goto skip_face;
-                            }
+                        }
+                        if (meshing::checkVertexes(face.vertexes, octree.getSize())) {
+                            continue;
                         }
                         face.scale = voxel_scale;
                         if constexpr (Face::col_ == Colour::On) {
@@ -967,16 +1195,15 @@ dual_marching_cube_kernel(const OctreeT& octree,
                                     octree, block_ptr, Eigen::Vector3i(x, y, z), voxel_scale, _)
                                     .id.id;
                         }
-#pragma omp critical(dual_marching_cubes)
-                        {
-                            mesh.push_back(face);
-                        }
-                    skip_face:;
+                        mesh[face_idx++] = face;
                     }
                 }
             }
         }
+        block_face_end[block_idx] = face_idx;
     }
+
+    meshing::remove_skipped_faces(mesh, block_face_begin, block_face_end);
     mesh.shrink_to_fit();
     return mesh;
 }
@@ -1185,6 +1412,12 @@ typename OctreeT::SurfaceMesh marching_cube(const OctreeT& octree,
          ++block_ptr_itr) {
         block_ptrs.push_back(static_cast<const BlockType*>(*block_ptr_itr));
     }
+    // Process the blocks in Morton order so that consecutive iterations access spatially nearby
+    // blocks. The neighbouring blocks fetched when meshing the block boundaries are then more
+    // likely to still be in the cache from recent iterations.
+    std::sort(block_ptrs.begin(), block_ptrs.end(), [](const BlockType* a, const BlockType* b) {
+        return keyops::encode_code(a->coord) < keyops::encode_code(b->coord);
+    });
     TOCK("marching-cube-create-block-list")
 
     typename OctreeT::SurfaceMesh mesh;
@@ -1213,6 +1446,10 @@ meshing::VertexIndexMesh<3> dual_marching_cube_new(const OctreeT& octree)
          ++block_ptr_itr) {
         block_ptrs.push_back(static_cast<const BlockType*>(*block_ptr_itr));
     }
+    // Process the blocks in Morton order, see se::algorithms::marching_cube().
+    std::sort(block_ptrs.begin(), block_ptrs.end(), [](const BlockType* a, const BlockType* b) {
+        return keyops::encode_code(a->coord) < keyops::encode_code(b->coord);
+    });
 
     const meshing::VertexIndexMesh<3> mesh =
         se::algorithms::dual_marching_cube_new(octree, block_ptrs);
@@ -9,6 +9,7 @@
 #ifndef SE_MARCHING_CUBE_HPP
 #define SE_MARCHING_CUBE_HPP
 
+#include <algorithm>
 #include <se/common/bounded_vector.hpp>
 #include <se/common/timings.hpp>
 #include <se/map/algorithms/edge_tables.hpp>
@@ -86,6 +87,27 @@ void gather_dual_data(const BlockT* block,
                       std::array<Eigen::Vector3f, 8>& dual_corner_coords_f,
                       std::array<Eigen::Vector3i, 8>& dual_corner_coords_i);
 
+/** Cache the data of all cells of \p block at \p scale in \p cell_data, which must have space for
+ * cube(BlockT::size / scale stride) elements. Cells are stored in x, y, z order with x the fastest
+ * changing index. The dual corner data of every primal corner in the block interior can then be
+ * read from the cache via the cached se::meshing::gather_dual_data() overload, instead of fetching
+ * the same cell from the block up to 8 times for the 8 primal corners it is adjacent to.
+ */
+template<typename BlockT, typename DataT>
+void gather_cell_data(const BlockT* block, const int scale, DataT* cell_data);
+
+/** Same as the block-local se::meshing::gather_dual_data() but reading the dual corner data from
+ * \p cell_data as cached by se::meshing::gather_cell_data().
+ */
+template<typename BlockT, typename DataT>
+void gather_dual_data(const BlockT* block,
+                      const int scale,
+                      const Eigen::Vector3i& primal_corner_coord,
+                      const DataT* cell_data,
+                      DataT data[8],
+                      std::array<Eigen::Vector3f, 8>& dual_corner_coords_f,
+                      std::array<Eigen::Vector3i, 8>& dual_corner_coords_i);
+
 /*! \brief The following strategy is derived from I. Wald, A Simple, General,
  *  and GPU Friendly Method for Computing Dual Mesh and Iso-Surfaces of Adaptive Mesh Refinement (AMR) Data, 2020
  *
@@ -147,8 +169,41 @@ void compute_dual_index(const OctreeT& octree,
                         std::array<Eigen::Vector3f, 8>& dual_corner_coords_f,
                         std::array<Eigen::Vector3i, 8>& dual_corner_coords_i);
 
+/** Same as se::meshing::compute_dual_index() but reading the dual corner data of primal corners in
+ * the block interior from \p cell_data as cached by se::meshing::gather_cell_data().
+ */
+template<typename OctreeT, typename DataT, typename DataToIndexF>
+void compute_dual_index(const OctreeT& octree,
+                        const typename OctreeT::BlockType* block_ptr,
+                        const int scale,
+                        const Eigen::Vector3i& primal_corner_coord,
+                        const DataT* cell_data,
+                        uint8_t& edge_pattern_idx,
+                        DataT data[8],
+                        std::array<Eigen::Vector3f, 8>& dual_corner_coords_f,
+                        std::array<Eigen::Vector3i, 8>& dual_corner_coords_i,
+                        DataToIndexF data_to_index);
+
 inline bool checkVertex(const Eigen::Vector3f& vertex_M, const float dim);
 
+/** Equivalent to calling se::meshing::checkVertex() on each vertex in \p vertexes_M and returning
+ * whether any call returned true, but tests all coefficients with branchless vectorized
+ * comparisons.
+ */
+template<size_t NumVertexes>
+bool checkVertexes(const std::array<Eigen::Vector3f, NumVertexes>& vertexes_M, const float dim);
+
+/** Compact \p mesh in-place after blocks wrote their faces to preallocated regions of it. Block \p
+ * block_idx was assigned the face range [\p block_face_begin[block_idx], \p block_face_begin[block_idx
+ * + 1]) and emitted faces in [\p block_face_begin[block_idx], \p block_face_end[block_idx]), leaving a
+ * gap at the end of its range for each face skipped due to invalid vertices. The mesh is resized to
+ * the number of faces actually emitted.
+ */
+template<typename MeshT>
+void remove_skipped_faces(MeshT& mesh,
+                          const std::vector<size_t>& block_face_begin,
+                          const std::vector<size_t>& block_face_end);
+
 } // namespace meshing
 
 
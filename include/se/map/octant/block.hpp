@@ -38,6 +38,14 @@ class BlockSingleRes {
 
     DataType& data(const Eigen::Vector3i& voxel_coord);
 
+    /** Copy the data of the \p num_coords voxels with coordinates in voxels \p voxel_coords into
+     * \p data_arr. Equivalent to \p num_coords calls to se::BlockSingleRes::data() but the block
+     * origin and data base pointer are only resolved once for the whole batch.
+     */
+    void dataBatch(const Eigen::Vector3i* voxel_coords,
+                   DataType* data_arr,
+                   const int num_coords) const;
+
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
     private:
@@ -118,6 +126,16 @@ class BlockMultiRes<Data<Field::TSDF, ColB, IdB>, BlockSize, DerivedT> {
 
     DataType& data(const Eigen::Vector3i& voxel_coord, const int scale);
 
+    /** Copy the data at \p scale of the \p num_coords voxels with coordinates in voxels \p
+     * voxel_coords into \p data_arr. Equivalent to \p num_coords calls to
+     * se::BlockMultiRes::data() but the block origin and the data base pointer at \p scale are
+     * only resolved once for the whole batch.
+     */
+    void dataBatch(const Eigen::Vector3i* voxel_coords,
+                   DataType* data_arr,
+                   const int num_coords,
+                   const int scale) const;
+
     DataUnion dataUnion(const Eigen::Vector3i& voxel_coord, const int scale);
 
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
@@ -214,6 +232,21 @@ class BlockMultiRes<Data<Field::Occupancy, ColB, IdB>, BlockSize, DerivedT> {
 
     DataType& data(const Eigen::Vector3i& voxel_coord, const int scale);
 
+    /**
+     * \brief Copy the data at \p scale of several voxels into \p data_arr in a single call.
+     *        Equivalent to \p num_coords calls to the per-voxel data() but the data array at
+     *        \p scale is only resolved once for the whole batch.
+     *
+     * \param[in]  voxel_coords The voxel coordinates of the \p num_coords voxels to be accessed.
+     * \param[out] data_arr     The array the data of the \p num_coords voxels is copied into.
+     * \param[in]  num_coords   The number of voxels to be accessed.
+     * \param[in]  scale        The scale the data is accessed at.
+     */
+    void dataBatch(const Eigen::Vector3i* voxel_coords,
+                   DataType* data_arr,
+                   const int num_coords,
+                   const int scale) const;
+
     const DataType& minData(const Eigen::Vector3i& voxel_coord) const;
 
     DataType& minData(const Eigen::Vector3i& voxel_coord);
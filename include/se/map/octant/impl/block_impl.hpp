@@ -66,6 +66,25 @@ BlockSingleRes<DataT, BlockSize, DerivedT>::data(const Eigen::Vector3i& voxel_co
 
 
 
+template<typename DataT, int BlockSize, typename DerivedT>
+void BlockSingleRes<DataT, BlockSize, DerivedT>::dataBatch(const Eigen::Vector3i* voxel_coords,
+                                                           DataType* data_arr,
+                                                           const int num_coords) const
+{
+    const Eigen::Vector3i& block_coord = underlying()->coord;
+    const DataType* const block_data = block_data_.data();
+    for (int i = 0; i < num_coords; i++) {
+        const Eigen::Vector3i voxel_offset = voxel_coords[i] - block_coord;
+        const int voxel_idx = voxel_offset.x() + voxel_offset.y() * BlockSize
+            + voxel_offset.z() * math::sq(BlockSize);
+        assert(voxel_idx >= 0);
+        assert(static_cast<size_t>(voxel_idx) < block_data_.size());
+        data_arr[i] = block_data[voxel_idx];
+    }
+}
+
+
+
 /// Multi-res Block ///
 
 template<Colour ColB, Id IdB, int BlockSize, typename DerivedT>
@@ -182,6 +201,27 @@ BlockMultiRes<Data<Field::TSDF, ColB, IdB>, BlockSize, DerivedT>::data(
 
 
 
+template<Colour ColB, Id IdB, int BlockSize, typename DerivedT>
+void BlockMultiRes<Data<Field::TSDF, ColB, IdB>, BlockSize, DerivedT>::dataBatch(
+    const Eigen::Vector3i* voxel_coords,
+    DataType* data_arr,
+    const int num_coords,
+    const int scale) const
+{
+    assert(scale >= 0);
+    assert(scale <= max_scale);
+    const Eigen::Vector3i& block_coord = underlying()->coord;
+    const int size_at_scale = size_at_scales_[scale];
+    const DataType* const data_at_scale = block_data_.data() + scale_offsets_[scale];
+    for (int i = 0; i < num_coords; i++) {
+        const Eigen::Vector3i voxel_offset = (voxel_coords[i] - block_coord) / (1 << scale);
+        data_arr[i] = data_at_scale[voxel_offset.x() + voxel_offset.y() * size_at_scale
+                                    + voxel_offset.z() * math::sq(size_at_scale)];
+    }
+}
+
+
+
 template<Colour ColB, Id IdB, int BlockSize, typename DerivedT>
 typename BlockMultiRes<Data<Field::TSDF, ColB, IdB>, BlockSize, DerivedT>::DataUnion
 BlockMultiRes<Data<Field::TSDF, ColB, IdB>, BlockSize, DerivedT>::dataUnion(
@@ -362,6 +402,31 @@ BlockMultiRes<Data<Field::Occupancy, ColB, IdB>, BlockSize, DerivedT>::data(
 
 
 
+template<Colour ColB, Id IdB, int BlockSize, typename DerivedT>
+void BlockMultiRes<Data<Field::Occupancy, ColB, IdB>, BlockSize, DerivedT>::dataBatch(
+    const Eigen::Vector3i* voxel_coords,
+    DataType* data_arr,
+    const int num_coords,
+    const int scale) const
+{
+    assert(scale >= 0);
+    assert(scale <= max_scale);
+    if (max_scale - (block_data_.size() - 1) > static_cast<size_t>(scale)) {
+        std::fill(data_arr, data_arr + num_coords, init_data);
+        return;
+    }
+    const Eigen::Vector3i& block_coord = underlying()->coord;
+    const int size_at_scale = BlockSize >> scale;
+    const DataType* const data_at_scale = block_data_[max_scale - scale];
+    for (int i = 0; i < num_coords; i++) {
+        const Eigen::Vector3i voxel_offset = (voxel_coords[i] - block_coord) / (1 << scale);
+        data_arr[i] = data_at_scale[voxel_offset.x() + voxel_offset.y() * size_at_scale
+                                    + voxel_offset.z() * math::sq(size_at_scale)];
+    }
+}
+
+
+
 template<Colour ColB, Id IdB, int BlockSize, typename DerivedT>
 const typename BlockMultiRes<Data<Field::Occupancy, ColB, IdB>, BlockSize, DerivedT>::DataType&
 BlockMultiRes<Data<Field::Occupancy, ColB, IdB>, BlockSize, DerivedT>::minData(
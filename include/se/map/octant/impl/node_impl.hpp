@@ -16,7 +16,9 @@ Node<DataT, ResT>::Node(const Eigen::Vector3i& coord, const int size, const Data
         OctantBase(coord, false, nullptr), NodeData<DataT, ResT>(init_data), size(size)
 {
     assert(math::is_power_of_two(size));
-    children_ptr_.fill(nullptr);
+    for (auto& child_ptr : children_ptr_) {
+        child_ptr.store(nullptr, std::memory_order_relaxed);
+    }
 }
 
 
@@ -29,7 +31,9 @@ Node<DataT, ResT>::Node(Node* const parent_ptr, const int child_idx, const DataT
 {
     assert(child_idx >= 0);
     assert(static_cast<size_t>(child_idx) < children_ptr_.size());
-    children_ptr_.fill(nullptr);
+    for (auto& child_ptr : children_ptr_) {
+        child_ptr.store(nullptr, std::memory_order_relaxed);
+    }
 }
 
 
@@ -49,7 +53,7 @@ const OctantBase* Node<DataT, ResT>::getChild(const int child_idx) const
 {
     assert(child_idx >= 0);
     assert(static_cast<size_t>(child_idx) < children_ptr_.size());
-    return children_ptr_[child_idx];
+    return children_ptr_[child_idx].load(std::memory_order_acquire);
 }
 
 
@@ -66,7 +70,25 @@ void Node<DataT, ResT>::setChild(const int child_idx, OctantBase* const child_pt
     else {
         child_mask &= ~(1 << child_idx);
     }
-    children_ptr_[child_idx] = child_ptr;
+    children_ptr_[child_idx].store(child_ptr, std::memory_order_release);
+}
+
+
+
+template<typename DataT, Res ResT>
+OctantBase* Node<DataT, ResT>::setChildIfNull(const int child_idx, OctantBase* const child_ptr)
+{
+    assert(child_idx >= 0);
+    assert(static_cast<size_t>(child_idx) < children_ptr_.size());
+    assert(child_ptr);
+    OctantBase* expected_ptr = nullptr;
+    if (children_ptr_[child_idx].compare_exchange_strong(
+            expected_ptr, child_ptr, std::memory_order_acq_rel, std::memory_order_acquire)) {
+        // Set the corresponding bit in OctantBase::child_mask.
+        child_mask |= 1 << child_idx;
+        return nullptr;
+    }
+    return expected_ptr;
 }
 
 
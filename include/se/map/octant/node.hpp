@@ -114,6 +114,14 @@ class Node : public OctantBase, public NodeData<DataT, ResT> {
      */
     void setChild(const int child_idx, OctantBase* const child_ptr);
 
+    /** Atomically set the node child with index \p child_idx to \p child_ptr if it's not
+     * allocated. The value of \p child_idx must be in the interval [0, 7] inclusive. Return
+     * nullptr if \p child_ptr was set or the pointer to the already allocated child otherwise.
+     * This allows several threads to race for the allocation of the same child with a well-defined
+     * winner.
+     */
+    OctantBase* setChildIfNull(const int child_idx, OctantBase* const child_ptr);
+
     /** Return the coordinates in voxels of the child with index \p child_idx. */
     Eigen::Vector3i getChildCoord(const int child_idx) const;
 
@@ -128,8 +136,10 @@ class Node : public OctantBase, public NodeData<DataT, ResT> {
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 
     private:
-    // Pointers to the eight node children. Must be nullptr for unallocated children.
-    std::array<OctantBase*, 8> children_ptr_;
+    // Pointers to the eight node children. Must be nullptr for unallocated children. The pointers
+    // are atomic so that children can be published with a compare-and-swap during concurrent
+    // allocation.
+    std::array<std::atomic<OctantBase*>, 8> children_ptr_;
 
     public:
     /** The edge length of the node in voxels. */
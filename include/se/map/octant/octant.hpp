@@ -9,6 +9,7 @@
 #ifndef SE_OCTANT_HPP
 #define SE_OCTANT_HPP
 
+#include <atomic>
 #include <se/common/math_util.hpp>
 #include <se/map/data.hpp>
 #include <se/map/utils/key_util.hpp>
@@ -29,9 +30,10 @@ class OctantBase {
     timestamp_t timestamp;
 
     /** The i-th least significant bit of the mask must be set if the i-th child of the octant is
-     * allocated.
+     * allocated. The mask is atomic so that bits for different children can be set concurrently
+     * during parallel allocation.
      */
-    std::uint8_t child_mask;
+    std::atomic<std::uint8_t> child_mask;
 
     /** Whether the octant is an se::Block. */
     const bool is_block;
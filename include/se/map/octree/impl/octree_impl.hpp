@@ -181,20 +181,27 @@ bool Octree<DataT, ResT, BlockSize>::allocate(NodeType* const parent_ptr,
     }
 
     const DataT& init_data = parent_ptr->data();
-    if (parent_ptr->size == 2 * BlockSize) {
-#pragma omp critical(octree_allocator)
-        {
-            child_ptr = memory_pool_.allocateBlock(parent_ptr, child_idx, init_data);
+    const bool child_is_block = parent_ptr->size == 2 * BlockSize;
+    OctantBase* const new_child_ptr = child_is_block
+        ? static_cast<OctantBase*>(memory_pool_.allocateBlock(parent_ptr, child_idx, init_data))
+        : static_cast<OctantBase*>(memory_pool_.allocateNode(parent_ptr, child_idx, init_data));
+    // Publish the new octant with a compare-and-swap. Another thread may have allocated the same
+    // child concurrently, in which case its octant is kept and ours is returned to the pool.
+    OctantBase* const existing_child_ptr = parent_ptr->setChildIfNull(child_idx, new_child_ptr);
+    if (existing_child_ptr) {
+        if (child_is_block) {
+            memory_pool_.deleteBlock(static_cast<BlockType*>(new_child_ptr));
         }
-        aabbExtend(child_ptr->coord, parent_ptr->size / 2);
-    }
-    else {
-#pragma omp critical(octree_allocator)
-        {
-            child_ptr = memory_pool_.allocateNode(parent_ptr, child_idx, init_data);
+        else {
+            memory_pool_.deleteNode(static_cast<NodeType*>(new_child_ptr));
         }
+        child_ptr = existing_child_ptr;
+        return false;
+    }
+    if (child_is_block) {
+        aabbExtend(new_child_ptr->coord, parent_ptr->size / 2);
     }
-    parent_ptr->setChild(child_idx, child_ptr);
+    child_ptr = new_child_ptr;
     return true;
 }
 
@@ -213,18 +220,20 @@ void Octree<DataT, ResT, BlockSize>::allocateChildren(NodeType* const parent_ptr
             continue;
         }
         if (children_are_blocks) {
-#pragma omp critical(octree_allocator)
-            {
-                child_ptr = memory_pool_.allocateBlock(parent_ptr, child_idx, init_data);
-            }
+            child_ptr = memory_pool_.allocateBlock(parent_ptr, child_idx, init_data);
         }
         else {
-#pragma omp critical(octree_allocator)
-            {
-                child_ptr = memory_pool_.allocateNode(parent_ptr, child_idx, init_data);
+            child_ptr = memory_pool_.allocateNode(parent_ptr, child_idx, init_data);
+        }
+        // Publish the new octant with a compare-and-swap, see se::Octree::allocate().
+        if (parent_ptr->setChildIfNull(child_idx, child_ptr)) {
+            if (children_are_blocks) {
+                memory_pool_.deleteBlock(static_cast<BlockType*>(child_ptr));
+            }
+            else {
+                memory_pool_.deleteNode(static_cast<NodeType*>(child_ptr));
             }
         }
-        parent_ptr->setChild(child_idx, child_ptr);
     }
     if (children_are_blocks) {
         // Blocks are always leaves and all of them have been allocated, extend the AABB to contain
@@ -238,20 +247,33 @@ void Octree<DataT, ResT, BlockSize>::allocateChildren(NodeType* const parent_ptr
 template<typename DataT, Res ResT, int BlockSize>
 void Octree<DataT, ResT, BlockSize>::deleteChildren(NodeType* const parent_ptr)
 {
+    // Traverse the subtrees with an explicit stack instead of recursing to avoid the overhead of
+    // up to 8 nested calls per internal node on deep octrees.
+    std::vector<OctantBase*> stack;
     for (int child_idx = 0; child_idx < 8; child_idx++) {
         OctantBase* const child_ptr = parent_ptr->getChild(child_idx);
         if (child_ptr) {
-            if (child_ptr->is_block) {
-                memory_pool_.deleteBlock(static_cast<BlockType*>(child_ptr));
-            }
-            else {
-                auto* const node_ptr = static_cast<NodeType*>(child_ptr);
-                deleteChildren(node_ptr);
-                memory_pool_.deleteNode(node_ptr);
-            }
+            stack.push_back(child_ptr);
             parent_ptr->setChild(child_idx, nullptr);
         }
     }
+    while (!stack.empty()) {
+        OctantBase* const octant_ptr = stack.back();
+        stack.pop_back();
+        if (octant_ptr->is_block) {
+            memory_pool_.deleteBlock(static_cast<BlockType*>(octant_ptr));
+        }
+        else {
+            auto* const node_ptr = static_cast<NodeType*>(octant_ptr);
+            for (int child_idx = 0; child_idx < 8; child_idx++) {
+                OctantBase* const child_ptr = node_ptr->getChild(child_idx);
+                if (child_ptr) {
+                    stack.push_back(child_ptr);
+                }
+            }
+            memory_pool_.deleteNode(node_ptr);
+        }
+    }
 }
 
 
@@ -11,6 +11,7 @@
 
 #include <Eigen/Geometry>
 #include <memory>
+#include <vector>
 #include <se/map/algorithms/marching_cube.hpp>
 #include <se/map/algorithms/mesh.hpp>
 #include <se/map/algorithms/structure_meshing.hpp>
@@ -138,7 +139,7 @@ class Octree {
     /** Allocate all the children of \p parent_ptr. */
     void allocateChildren(NodeType* const parent_ptr);
 
-    /** Recursively delete all the children of \p parent_ptr. */
+    /** Delete all octants in the subtrees rooted at the children of \p parent_ptr. */
     void deleteChildren(NodeType* const parent_ptr);
 
     /** Return the axis-aligned bounding box of the octree's allocated leaves. The bounding box is
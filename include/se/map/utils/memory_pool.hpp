@@ -10,7 +10,13 @@
 #define SE_MEMORY_POOL_HPP
 
 #include <Eigen/Core>
-#include <boost/pool/object_pool.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <mutex>
+#include <new>
+#include <vector>
 
 namespace se {
 
@@ -18,6 +24,10 @@ namespace se {
  * still allocated nodes and blocks are called on destruction of the se::MemoryPool object. User
  * code shouldn't use se::MemoryPool directly as all usage is internal in se::Octree.
  *
+ * Allocations are served by atomically bumping an index into chunked arenas, so concurrent
+ * allocations from multiple threads don't serialize on a lock. A mutex is only taken on the rare
+ * slow paths: growing the arena by a chunk and recycling deallocated octants.
+ *
  * \warning Never deallocate nodes/blocks created through se::MemoryPool using \p delete.
  *
  * \note Since se::MemoryPool does its own memory management on top of large heap allocations, it
@@ -32,7 +42,7 @@ class MemoryPool {
      */
     NodeT* allocateRoot(const Eigen::Vector3i& coord, const int size)
     {
-        return new (node_buffer_.malloc()) NodeT(coord, size, typename NodeT::DataType());
+        return new (node_buffer_.allocate()) NodeT(coord, size, typename NodeT::DataType());
     }
 
     /** Return a pointer to a newly allocated node that is the child with index \p child_idx of \p
@@ -42,7 +52,7 @@ class MemoryPool {
                         const int child_idx,
                         const typename NodeT::DataType& init_data)
     {
-        return new (node_buffer_.malloc()) NodeT(parent_ptr, child_idx, init_data);
+        return new (node_buffer_.allocate()) NodeT(parent_ptr, child_idx, init_data);
     }
 
     /** Return a pointer to a newly allocated block that is the child with index \p child_idx of \p
@@ -52,7 +62,7 @@ class MemoryPool {
                           const int child_idx,
                           const typename BlockT::DataType& init_data)
     {
-        return new (block_buffer_.malloc()) BlockT(parent_ptr, child_idx, init_data);
+        return new (block_buffer_.allocate()) BlockT(parent_ptr, child_idx, init_data);
     }
 
     /** Destruct and deallocate the node pointed to by \p node_ptr. */
@@ -68,8 +78,108 @@ class MemoryPool {
     }
 
     private:
-    boost::object_pool<NodeT> node_buffer_;
-    boost::object_pool<BlockT> block_buffer_;
+    /** A growing arena of uninitialized, properly aligned slots for objects of type T. Slots are
+     * handed out by atomically bumping an index into chunks of geometrically increasing capacity,
+     * chunk c holding `first_chunk_capacity * 2^c` slots. Destroyed slots are recycled through a
+     * free list.
+     */
+    template<typename T>
+    class Buffer {
+        public:
+        ~Buffer()
+        {
+            // Destruct all objects that are still allocated, that is all bump-allocated slots
+            // except those on the free list.
+            std::sort(free_slots_.begin(), free_slots_.end());
+            const size_t num_slots = next_slot_idx_.load(std::memory_order_relaxed);
+            for (size_t slot_idx = 0; slot_idx < num_slots; slot_idx++) {
+                T* const ptr = slot(slot_idx);
+                if (!std::binary_search(free_slots_.begin(), free_slots_.end(), ptr)) {
+                    ptr->~T();
+                }
+            }
+            for (size_t chunk_idx = 0; chunk_idx < num_chunks_.load(std::memory_order_relaxed);
+                 chunk_idx++) {
+                ::operator delete(chunks_[chunk_idx], std::align_val_t(alignof(T)));
+            }
+        }
+
+        /** Return a pointer to uninitialized storage for a single object of type T. */
+        void* allocate()
+        {
+            // Recycle a previously destroyed slot if there is one. The atomic counter keeps the
+            // common case, no deallocations pending, off the mutex.
+            if (num_free_slots_.load(std::memory_order_relaxed) > 0) {
+                const std::lock_guard<std::mutex> lock(mutex_);
+                if (!free_slots_.empty()) {
+                    T* const ptr = free_slots_.back();
+                    free_slots_.pop_back();
+                    num_free_slots_.fetch_sub(1, std::memory_order_relaxed);
+                    return ptr;
+                }
+            }
+            const size_t slot_idx = next_slot_idx_.fetch_add(1, std::memory_order_relaxed);
+            const size_t chunk_idx = chunkIdx(slot_idx);
+            assert(chunk_idx < max_num_chunks);
+            if (chunk_idx >= num_chunks_.load(std::memory_order_acquire)) {
+                const std::lock_guard<std::mutex> lock(mutex_);
+                while (chunk_idx >= num_chunks_.load(std::memory_order_relaxed)) {
+                    const size_t new_chunk_idx = num_chunks_.load(std::memory_order_relaxed);
+                    chunks_[new_chunk_idx] = static_cast<T*>(
+                        ::operator new(sizeof(T) * (first_chunk_capacity << new_chunk_idx),
+                                       std::align_val_t(alignof(T))));
+                    // The release store publishes the chunk pointer to the acquire load above.
+                    num_chunks_.fetch_add(1, std::memory_order_release);
+                }
+            }
+            return slot(slot_idx);
+        }
+
+        /** Destruct the object pointed to by \p ptr and recycle its slot. */
+        void destroy(T* const ptr)
+        {
+            ptr->~T();
+            const std::lock_guard<std::mutex> lock(mutex_);
+            free_slots_.push_back(ptr);
+            num_free_slots_.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        private:
+        /** Return the index of the chunk containing the slot with index \p slot_idx. */
+        static size_t chunkIdx(const size_t slot_idx)
+        {
+            // The capacity of all chunks up to and including chunk c is
+            // first_chunk_capacity * (2^(c+1) - 1).
+            size_t chunk_idx = 0;
+            while ((slot_idx / first_chunk_capacity + 1) >> (chunk_idx + 1)) {
+                chunk_idx++;
+            }
+            return chunk_idx;
+        }
+
+        /** Return a pointer to the slot with index \p slot_idx. */
+        T* slot(const size_t slot_idx) const
+        {
+            const size_t chunk_idx = chunkIdx(slot_idx);
+            const size_t offset =
+                slot_idx - first_chunk_capacity * ((size_t(1) << chunk_idx) - 1);
+            return chunks_[chunk_idx] + offset;
+        }
+
+        static constexpr size_t first_chunk_capacity = 64;
+        // With doubling chunk capacities 64 chunks are enough for any request that fits in memory.
+        static constexpr size_t max_num_chunks = 64;
+
+        std::array<T*, max_num_chunks> chunks_ = {};
+        std::atomic<size_t> next_slot_idx_{0};
+        std::atomic<size_t> num_chunks_{0};
+        std::atomic<size_t> num_free_slots_{0};
+        std::vector<T*> free_slots_;
+        std::mutex mutex_;
+    };
+
+    Buffer<NodeT> node_buffer_;
+    Buffer<BlockT> block_buffer_;
 };
 
 } // namespace se
@@ -31,11 +31,24 @@ enum TrackingResult {
 struct Data {
     TrackingResult result = ResultUnknown;
     float error = 0.0f;
-    float J[6] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    /** The Jacobian is stored in half precision to reduce the size of the per-pixel data streamed
+     * through se::icp::reduceKernel(), which is memory-bound at image resolution. It's converted
+     * back to single precision in se::icp::newReduce() and all accumulation is performed in single
+     * precision, so the pose solve is unaffected.
+     */
+    Eigen::half J[6] = {Eigen::half(0.0f),
+                        Eigen::half(0.0f),
+                        Eigen::half(0.0f),
+                        Eigen::half(0.0f),
+                        Eigen::half(0.0f),
+                        Eigen::half(0.0f)};
 };
 
 
 
+/** Return the matrix J^T * J given its 21 upper triangular elements \p v in row-major order. Only
+ * the upper triangle of the returned matrix is filled, the lower triangle is zero.
+ */
 Eigen::Matrix<float, 6, 6> makeJTJ(const Eigen::Matrix<float, 1, 21>& v);
 
 Eigen::Matrix<float, 6, 1> solve(const Eigen::Matrix<float, 1, 27>& vals);
@@ -70,6 +83,27 @@ void trackKernel(Data* output_data,
                  const float dist_threshold,
                  const float normal_threshold);
 
+/**
+ * Fusion of se::icp::trackKernel() and se::icp::reduceKernel() into a single pass. The Jacobian and
+ * error of each pixel are accumulated into the reduction sums while still in registers, so the
+ * per-pixel se::icp::Data stream that dominates the DRAM traffic of the separate kernels is never
+ * materialized. Only the result member of \p J_data is written, as needed by
+ * se::Tracker::renderTrackingResult(). The 32 reduction values are written to the first row of
+ * \p output_data in the same layout produced by se::icp::reduceKernel().
+ */
+template<typename ProjectF>
+void trackAndReduceKernel(float* output_data,
+                          Data* J_data,
+                          const Image<Eigen::Vector3f>& input_point_cloud_S,
+                          const Image<Eigen::Vector3f>& input_normals_S,
+                          const Image<Eigen::Vector3f>& surface_point_cloud_M_ref,
+                          const Image<Eigen::Vector3f>& surface_normals_M_ref,
+                          const Eigen::Isometry3f& T_WS,
+                          const Eigen::Isometry3f& T_WS_ref,
+                          const ProjectF project,
+                          const float dist_threshold,
+                          const float normal_threshold);
+
 bool updatePoseKernel(Eigen::Isometry3f& T_WS,
                       const float* reduction_output_data,
                       const float icp_threshold);
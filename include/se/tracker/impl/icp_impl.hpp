@@ -89,18 +89,177 @@ void trackKernel(Data* output_data,
             }
             row.result = ResultSuccess;
             row.error = ref_normal_W.dot(diff);
-            row.J[0] = ref_normal_W.x();
-            row.J[1] = ref_normal_W.y();
-            row.J[2] = ref_normal_W.z();
+            row.J[0] = Eigen::half(ref_normal_W.x());
+            row.J[1] = Eigen::half(ref_normal_W.y());
+            row.J[2] = Eigen::half(ref_normal_W.z());
 
             const Eigen::Vector3f cross_prod = point_W.cross(ref_normal_W);
-            row.J[3] = cross_prod.x();
-            row.J[4] = cross_prod.y();
-            row.J[5] = cross_prod.z();
+            row.J[3] = Eigen::half(cross_prod.x());
+            row.J[4] = Eigen::half(cross_prod.y());
+            row.J[5] = Eigen::half(cross_prod.z());
         }
     }
 }
 
+template<typename ProjectF>
+void trackAndReduceKernel(float* output_data,
+                          Data* J_data,
+                          const Image<Eigen::Vector3f>& input_point_cloud_S,
+                          const Image<Eigen::Vector3f>& input_normals_S,
+                          const Image<Eigen::Vector3f>& surface_point_cloud_W_ref,
+                          const Image<Eigen::Vector3f>& surface_normals_W_ref,
+                          const Eigen::Isometry3f& T_WS,
+                          const Eigen::Isometry3f& T_WS_ref,
+                          const ProjectF project,
+                          const float dist_threshold,
+                          const float normal_threshold)
+{
+    const Eigen::Vector2i input_res(input_point_cloud_S.width(), input_point_cloud_S.height());
+    const Eigen::Vector2i ref_res(surface_point_cloud_W_ref.width(),
+                                  surface_point_cloud_W_ref.height());
+
+    float sums0 = 0.0f, sums1 = 0.0f, sums2 = 0.0f, sums3 = 0.0f, sums4 = 0.0f, sums5 = 0.0f,
+          sums6 = 0.0f, sums7 = 0.0f, sums8 = 0.0f, sums9 = 0.0f, sums10 = 0.0f, sums11 = 0.0f,
+          sums12 = 0.0f, sums13 = 0.0f, sums14 = 0.0f, sums15 = 0.0f, sums16 = 0.0f, sums17 = 0.0f,
+          sums18 = 0.0f, sums19 = 0.0f, sums20 = 0.0f, sums21 = 0.0f, sums22 = 0.0f, sums23 = 0.0f,
+          sums24 = 0.0f, sums25 = 0.0f, sums26 = 0.0f, sums27 = 0.0f, sums28 = 0.0f, sums29 = 0.0f,
+          sums30 = 0.0f, sums31 = 0.0f;
+
+    const int h = input_res.y(); // clang complains if this is inside the for loop
+    const int w = input_res.x(); // clang complains if this is inside the for loop
+#pragma omp parallel for reduction(+:sums0,sums1,sums2,sums3,sums4,sums5,sums6,sums7,sums8,sums9,sums10,sums11,sums12,sums13,sums14,sums15,sums16,sums17,sums18,sums19,sums20,sums21,sums22,sums23,sums24,sums25,sums26,sums27,sums28,sums29,sums30,sums31)
+    for (int y = 0; y < h; y++) {
+        for (int x = 0; x < w; x++) {
+            const Eigen::Vector2i pixel(x, y);
+
+            // Only the tracking result is stored per-pixel. The error and Jacobian are accumulated
+            // into the reduction sums below without ever being written to memory.
+            TrackingResult& result = J_data[pixel.x() + pixel.y() * ref_res.x()].result;
+            float error = 0.0f;
+            float J0 = 0.0f, J1 = 0.0f, J2 = 0.0f, J3 = 0.0f, J4 = 0.0f, J5 = 0.0f;
+            if (input_normals_S[pixel.x() + pixel.y() * w] == math::g_invalid_normal) {
+                result = ResultInvalidInputNormal;
+            }
+            else {
+                const Eigen::Vector3f point_W =
+                    T_WS * input_point_cloud_S[pixel.x() + pixel.y() * w];
+                const Eigen::Vector3f point_S_ref = T_WS_ref.inverse() * point_W;
+
+                Eigen::Vector2f ref_pixel_f;
+                if (!project(point_S_ref, ref_pixel_f)) {
+                    result = ResultProjectionOutside;
+                }
+                else {
+                    const Eigen::Vector2i ref_pixel = round_pixel(ref_pixel_f);
+                    // The reference normal is inverted for the same reason as in
+                    // se::icp::trackKernel().
+                    const Eigen::Vector3f ref_normal_W =
+                        -surface_normals_W_ref[ref_pixel.x() + ref_pixel.y() * ref_res.x()];
+
+                    if (ref_normal_W == math::g_invalid_normal) {
+                        result = ResultInvalidRefNormal;
+                    }
+                    else {
+                        const Eigen::Vector3f ref_point_W =
+                            surface_point_cloud_W_ref[ref_pixel.x() + ref_pixel.y() * ref_res.x()];
+                        const Eigen::Vector3f diff = ref_point_W - point_W;
+                        const Eigen::Vector3f input_normal_W =
+                            T_WS.linear() * input_normals_S[pixel.x() + pixel.y() * w];
+
+                        if (diff.norm() > dist_threshold) {
+                            result = ResultDistThreshold;
+                        }
+                        else if (input_normal_W.dot(ref_normal_W) < normal_threshold) {
+                            result = ResultNormalThreshold;
+                        }
+                        else {
+                            result = ResultSuccess;
+                            error = ref_normal_W.dot(diff);
+                            J0 = ref_normal_W.x();
+                            J1 = ref_normal_W.y();
+                            J2 = ref_normal_W.z();
+                            const Eigen::Vector3f cross_prod = point_W.cross(ref_normal_W);
+                            J3 = cross_prod.x();
+                            J4 = cross_prod.y();
+                            J5 = cross_prod.z();
+                        }
+                    }
+                }
+            }
+
+            if (result < ResultSuccess) {
+                sums29 += result == ResultDistThreshold ? 1 : 0;
+                sums30 += result == ResultNormalThreshold ? 1 : 0;
+                sums31 += result > ResultDistThreshold ? 1 : 0;
+                continue;
+            }
+            // Same accumulation as in se::icp::newReduce().
+            sums0 += error * error;
+            sums1 += error * J0;
+            sums2 += error * J1;
+            sums3 += error * J2;
+            sums4 += error * J3;
+            sums5 += error * J4;
+            sums6 += error * J5;
+            sums7 += J0 * J0;
+            sums8 += J0 * J1;
+            sums9 += J0 * J2;
+            sums10 += J0 * J3;
+            sums11 += J0 * J4;
+            sums12 += J0 * J5;
+            sums13 += J1 * J1;
+            sums14 += J1 * J2;
+            sums15 += J1 * J3;
+            sums16 += J1 * J4;
+            sums17 += J1 * J5;
+            sums18 += J2 * J2;
+            sums19 += J2 * J3;
+            sums20 += J2 * J4;
+            sums21 += J2 * J5;
+            sums22 += J3 * J3;
+            sums23 += J3 * J4;
+            sums24 += J3 * J5;
+            sums25 += J4 * J4;
+            sums26 += J4 * J5;
+            sums27 += J5 * J5;
+            sums28 += 1;
+        }
+    }
+
+    output_data[0] = sums0;
+    output_data[1] = sums1;
+    output_data[2] = sums2;
+    output_data[3] = sums3;
+    output_data[4] = sums4;
+    output_data[5] = sums5;
+    output_data[6] = sums6;
+    output_data[7] = sums7;
+    output_data[8] = sums8;
+    output_data[9] = sums9;
+    output_data[10] = sums10;
+    output_data[11] = sums11;
+    output_data[12] = sums12;
+    output_data[13] = sums13;
+    output_data[14] = sums14;
+    output_data[15] = sums15;
+    output_data[16] = sums16;
+    output_data[17] = sums17;
+    output_data[18] = sums18;
+    output_data[19] = sums19;
+    output_data[20] = sums20;
+    output_data[21] = sums21;
+    output_data[22] = sums22;
+    output_data[23] = sums23;
+    output_data[24] = sums24;
+    output_data[25] = sums25;
+    output_data[26] = sums26;
+    output_data[27] = sums27;
+    output_data[28] = sums28;
+    output_data[29] = sums29;
+    output_data[30] = sums30;
+    output_data[31] = sums31;
+}
+
 } // namespace icp
 } // namespace se
 
@@ -82,11 +82,9 @@ bool Tracker<MapT, SensorT>::track(const Image<float>& depth_img,
     }
 
     for (int level = config_.iterations.size() - 1; level >= 0; --level) {
-        Eigen::Vector2i reduction_output_res(depth_img_res.x() / (int) pow(2, level),
-                                             depth_img_res.y() / (int) pow(2, level));
-
         for (int i = 0; i < config_.iterations[level]; ++i) {
-            icp::trackKernel(
+            icp::trackAndReduceKernel(
+                reduction_output.data(),
                 tracking_result.data(),
                 input_point_cloud_S[level],
                 input_normals_S[level],
@@ -101,11 +99,6 @@ bool Tracker<MapT, SensorT>::track(const Image<float>& depth_img,
                 config_.dist_threshold,
                 config_.normal_threshold);
 
-            icp::reduceKernel(reduction_output.data(),
-                              reduction_output_res,
-                              tracking_result.data(),
-                              depth_img_res);
-
             if (icp::updatePoseKernel(T_WS, reduction_output.data(), config_.icp_threshold)) {
                 break;
             }
@@ -14,6 +14,8 @@ namespace icp {
 
 Eigen::Matrix<float, 6, 6> makeJTJ(const Eigen::Matrix<float, 1, 21>& v)
 {
+    // Only the upper triangle is filled since the matrix is symmetric and se::icp::solve() only
+    // reads the upper triangle, making the mirroring into the lower triangle unnecessary.
     Eigen::Matrix<float, 6, 6> C = Eigen::Matrix<float, 6, 6>::Zero();
     C.row(0) = v.segment(0, 6);
     C.row(1).segment(1, 5) = v.segment(6, 5);
@@ -21,10 +23,6 @@ Eigen::Matrix<float, 6, 6> makeJTJ(const Eigen::Matrix<float, 1, 21>& v)
     C.row(3).segment(3, 3) = v.segment(15, 3);
     C.row(4).segment(4, 2) = v.segment(18, 2);
     C(5, 5) = v(20);
-
-    for (int r = 1; r < 6; ++r)
-        for (int c = 0; c < r; ++c)
-            C(r, c) = C(c, r);
     return C;
 }
 
@@ -34,7 +32,7 @@ Eigen::Matrix<float, 6, 1> solve(const Eigen::Matrix<float, 1, 27>& vals)
 {
     const Eigen::Matrix<float, 6, 1> b = vals.segment(0, 6);
     const Eigen::Matrix<float, 6, 6> C = makeJTJ(vals.segment(6, 21));
-    Eigen::LLT<Eigen::Matrix<float, 6, 6>> llt;
+    Eigen::LLT<Eigen::Matrix<float, 6, 6>, Eigen::Upper> llt;
     llt.compute(C);
     Eigen::Matrix<float, 6, 1> res = llt.solve(b);
     return llt.info() == Eigen::Success ? res : Eigen::Matrix<float, 6, 1>::Zero();
@@ -102,48 +100,56 @@ void newReduce(const int block_idx,
 
                 continue;
             }
+            // Upconvert the half precision Jacobian once and accumulate in single precision.
+            const float J0 = static_cast<float>(row.J[0]);
+            const float J1 = static_cast<float>(row.J[1]);
+            const float J2 = static_cast<float>(row.J[2]);
+            const float J3 = static_cast<float>(row.J[3]);
+            const float J4 = static_cast<float>(row.J[4]);
+            const float J5 = static_cast<float>(row.J[5]);
+
             // Error part
             /*sums[0]*/ sums0 += row.error * row.error;
 
             // JTe part
             /*for(int i = 0; i < 6; ++i)
         sums[i+1] += row.error * row.J[i];*/
-            sums1 += row.error * row.J[0];
-            sums2 += row.error * row.J[1];
-            sums3 += row.error * row.J[2];
-            sums4 += row.error * row.J[3];
-            sums5 += row.error * row.J[4];
-            sums6 += row.error * row.J[5];
+            sums1 += row.error * J0;
+            sums2 += row.error * J1;
+            sums3 += row.error * J2;
+            sums4 += row.error * J3;
+            sums5 += row.error * J4;
+            sums6 += row.error * J5;
 
             // JTJ part, unfortunatly the double loop is not unrolled well...
-            /*(sums+7)[0]*/ sums7 += row.J[0] * row.J[0];
-            /*(sums+7)[1]*/ sums8 += row.J[0] * row.J[1];
-            /*(sums+7)[2]*/ sums9 += row.J[0] * row.J[2];
-            /*(sums+7)[3]*/ sums10 += row.J[0] * row.J[3];
+            /*(sums+7)[0]*/ sums7 += J0 * J0;
+            /*(sums+7)[1]*/ sums8 += J0 * J1;
+            /*(sums+7)[2]*/ sums9 += J0 * J2;
+            /*(sums+7)[3]*/ sums10 += J0 * J3;
 
-            /*(sums+7)[4]*/ sums11 += row.J[0] * row.J[4];
-            /*(sums+7)[5]*/ sums12 += row.J[0] * row.J[5];
+            /*(sums+7)[4]*/ sums11 += J0 * J4;
+            /*(sums+7)[5]*/ sums12 += J0 * J5;
 
-            /*(sums+7)[6]*/ sums13 += row.J[1] * row.J[1];
-            /*(sums+7)[7]*/ sums14 += row.J[1] * row.J[2];
-            /*(sums+7)[8]*/ sums15 += row.J[1] * row.J[3];
-            /*(sums+7)[9]*/ sums16 += row.J[1] * row.J[4];
+            /*(sums+7)[6]*/ sums13 += J1 * J1;
+            /*(sums+7)[7]*/ sums14 += J1 * J2;
+            /*(sums+7)[8]*/ sums15 += J1 * J3;
+            /*(sums+7)[9]*/ sums16 += J1 * J4;
 
-            /*(sums+7)[10]*/ sums17 += row.J[1] * row.J[5];
+            /*(sums+7)[10]*/ sums17 += J1 * J5;
 
-            /*(sums+7)[11]*/ sums18 += row.J[2] * row.J[2];
-            /*(sums+7)[12]*/ sums19 += row.J[2] * row.J[3];
-            /*(sums+7)[13]*/ sums20 += row.J[2] * row.J[4];
-            /*(sums+7)[14]*/ sums21 += row.J[2] * row.J[5];
+            /*(sums+7)[11]*/ sums18 += J2 * J2;
+            /*(sums+7)[12]*/ sums19 += J2 * J3;
+            /*(sums+7)[13]*/ sums20 += J2 * J4;
+            /*(sums+7)[14]*/ sums21 += J2 * J5;
 
-            /*(sums+7)[15]*/ sums22 += row.J[3] * row.J[3];
-            /*(sums+7)[16]*/ sums23 += row.J[3] * row.J[4];
-            /*(sums+7)[17]*/ sums24 += row.J[3] * row.J[5];
+            /*(sums+7)[15]*/ sums22 += J3 * J3;
+            /*(sums+7)[16]*/ sums23 += J3 * J4;
+            /*(sums+7)[17]*/ sums24 += J3 * J5;
 
-            /*(sums+7)[18]*/ sums25 += row.J[4] * row.J[4];
-            /*(sums+7)[19]*/ sums26 += row.J[4] * row.J[5];
+            /*(sums+7)[18]*/ sums25 += J4 * J4;
+            /*(sums+7)[19]*/ sums26 += J4 * J5;
 
-            /*(sums+7)[20]*/ sums27 += row.J[5] * row.J[5];
+            /*(sums+7)[20]*/ sums27 += J5 * J5;
 
             // extra info here
             /*(sums+28)[0]*/ sums28 += 1;
@@ -0,0 +1,33 @@
+/*
+ * SPDX-FileCopyrightText: 2024 Smart Robotics Lab, Imperial College London, Technical University of Munich
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <gtest/gtest.h>
+#include <random>
+#include <se/common/image_utils.hpp>
+#include <vector>
+
+TEST(ImageUtils, roundPixels)
+{
+    std::vector<Eigen::Vector2f> pixels_f;
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> distrib(0.0f, 1024.0f);
+    for (int i = 0; i < 1000; i++) {
+        pixels_f.emplace_back(distrib(gen), distrib(gen));
+    }
+    // Add some exact and half-pixel positions as well.
+    pixels_f.emplace_back(0.0f, 0.0f);
+    pixels_f.emplace_back(1.5f, 2.5f);
+    pixels_f.emplace_back(3.0f, 4.0f);
+
+    std::vector<Eigen::Vector2i> pixels(pixels_f.size());
+    se::round_pixels(pixels_f.data(), pixels.data(), pixels_f.size());
+
+    for (size_t i = 0; i < pixels_f.size(); i++) {
+        EXPECT_EQ(pixels[i], se::round_pixel(pixels_f[i]));
+    }
+
+    // Rounding an empty batch shouldn't dereference the pointers.
+    se::round_pixels(nullptr, nullptr, 0);
+}